@@ -0,0 +1,60 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+#include "Enums.h"
+
+inline uint32_t encodeInstruction(OpCode op, FlagType flag, uint8_t src, uint8_t dest) {
+    uint32_t byte0 = (static_cast<uint32_t>(op) << 2) | static_cast<uint32_t>(flag);
+    return byte0 | (static_cast<uint32_t>(src) << 16) | (static_cast<uint32_t>(dest) << 24);
+}
+
+constexpr uint8_t BENCH_R0 = static_cast<uint8_t>(RegisterID::R0);
+constexpr uint8_t BENCH_R1 = static_cast<uint8_t>(RegisterID::R1);
+constexpr uint8_t BENCH_R2 = static_cast<uint8_t>(RegisterID::R2);
+
+// Short loop used to populate many VM instances.
+inline std::vector<uint32_t> smallLoopProgram() {
+    return {
+        encodeInstruction(OpCode::MOV, FlagType::REG_VAL, 0, BENCH_R0),
+        encodeInstruction(OpCode::MOV, FlagType::REG_VAL, 3, BENCH_R1),
+        encodeInstruction(OpCode::ADD, FlagType::REG_VAL, 1, BENCH_R0),
+        encodeInstruction(OpCode::PUSH, FlagType::SINGLE_REG, 0, BENCH_R0),
+        encodeInstruction(OpCode::POP, FlagType::SINGLE_REG, 0, BENCH_R0),
+        encodeInstruction(OpCode::CMP, FlagType::REG_REG, BENCH_R1, BENCH_R0),
+        encodeInstruction(OpCode::BNE, FlagType::SINGLE_VAL, 0, 2),
+    };
+}
+
+// Nested 200 x 200 loop mixing arithmetic, stack traffic and branches.
+inline std::vector<uint32_t> nestedLoopProgram() {
+    return {
+        encodeInstruction(OpCode::MOV, FlagType::REG_VAL, 0, BENCH_R0),
+        encodeInstruction(OpCode::MOV, FlagType::REG_VAL, 0, BENCH_R1),
+        encodeInstruction(OpCode::ADD, FlagType::REG_VAL, 1, BENCH_R1),
+        encodeInstruction(OpCode::PUSH, FlagType::SINGLE_REG, 0, BENCH_R1),
+        encodeInstruction(OpCode::POP, FlagType::SINGLE_REG, 0, BENCH_R2),
+        encodeInstruction(OpCode::CMP, FlagType::REG_VAL, 200, BENCH_R1),
+        encodeInstruction(OpCode::BNE, FlagType::SINGLE_VAL, 0, 2),
+        encodeInstruction(OpCode::ADD, FlagType::REG_VAL, 1, BENCH_R0),
+        encodeInstruction(OpCode::CMP, FlagType::REG_VAL, 200, BENCH_R0),
+        encodeInstruction(OpCode::BNE, FlagType::SINGLE_VAL, 0, 1),
+    };
+}
+
+// 256 iterations of four pushes and four pops; scaled-up test/text/stack.txt.
+inline std::vector<uint32_t> stackChurnProgram() {
+    return {
+        encodeInstruction(OpCode::MOV, FlagType::REG_VAL, 0, BENCH_R0),
+        encodeInstruction(OpCode::PUSH, FlagType::SINGLE_REG, 0, BENCH_R0),
+        encodeInstruction(OpCode::PUSH, FlagType::SINGLE_VAL, 0, 1),
+        encodeInstruction(OpCode::PUSH, FlagType::SINGLE_VAL, 0, 2),
+        encodeInstruction(OpCode::PUSH, FlagType::SINGLE_VAL, 0, 3),
+        encodeInstruction(OpCode::POP, FlagType::SINGLE_REG, 0, BENCH_R1),
+        encodeInstruction(OpCode::POP, FlagType::SINGLE_REG, 0, BENCH_R1),
+        encodeInstruction(OpCode::POP, FlagType::SINGLE_REG, 0, BENCH_R1),
+        encodeInstruction(OpCode::POP, FlagType::SINGLE_REG, 0, BENCH_R2),
+        encodeInstruction(OpCode::ADD, FlagType::REG_VAL, 1, BENCH_R0),
+        encodeInstruction(OpCode::CMP, FlagType::REG_VAL, 0, BENCH_R0),
+        encodeInstruction(OpCode::BNE, FlagType::SINGLE_VAL, 0, 1),
+    };
+}
@@ -0,0 +1,143 @@
+#include "PerfCounters.h"
+#include <cerrno>
+#include <cstring>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+#ifdef __linux__
+struct EventConfig {
+    uint32_t type;
+    uint64_t config;
+};
+
+constexpr uint64_t cacheMissConfig(uint64_t cache) {
+    return cache |
+           (static_cast<uint64_t>(PERF_COUNT_HW_CACHE_OP_READ) << 8) |
+           (static_cast<uint64_t>(PERF_COUNT_HW_CACHE_RESULT_MISS) << 16);
+}
+
+constexpr std::array<EventConfig, PERF_EVENT_COUNT> EVENT_CONFIGS = {{
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES},
+    {PERF_TYPE_HW_CACHE, cacheMissConfig(PERF_COUNT_HW_CACHE_L1D)},
+    {PERF_TYPE_HW_CACHE, cacheMissConfig(PERF_COUNT_HW_CACHE_LL)},
+}};
+
+// All events share one group so the PMU schedules them together; ratios
+// between them then come from the same time slices.
+int openEvent(const EventConfig& config, int groupFd) {
+    perf_event_attr attr{};
+    attr.size = sizeof(attr);
+    attr.type = config.type;
+    attr.config = config.config;
+    attr.disabled = groupFd < 0 ? 1 : 0;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+    return static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, groupFd, PERF_FLAG_FD_CLOEXEC));
+}
+#endif
+
+}
+
+PerfCounters::PerfCounters() : m_fds{}, m_groupOrder{}, m_groupSize(0), m_leaderFd(-1), m_startTime() {
+    m_fds.fill(-1);
+#ifdef __linux__
+    for (size_t i = 0; i < PERF_EVENT_COUNT; ++i) {
+        m_fds[i] = openEvent(EVENT_CONFIGS[i], m_leaderFd);
+        if (m_fds[i] >= 0) {
+            if (m_leaderFd < 0) {
+                m_leaderFd = m_fds[i];
+            }
+            m_groupOrder[m_groupSize++] = i;
+        } else if (m_unavailableReason.empty()) {
+            m_unavailableReason = std::string("perf_event_open failed for ") +
+                                  getEventName(static_cast<PerfEvent>(i)) + ": " + std::strerror(errno);
+        }
+    }
+#else
+    m_unavailableReason = "hardware counters are only supported on Linux";
+#endif
+}
+
+PerfCounters::~PerfCounters() {
+#ifdef __linux__
+    for (int fd : m_fds) {
+        if (fd >= 0) {
+            close(fd);
+        }
+    }
+#endif
+}
+
+bool PerfCounters::available() const {
+    return m_leaderFd >= 0;
+}
+
+const std::string& PerfCounters::getUnavailableReason() const {
+    return m_unavailableReason;
+}
+
+void PerfCounters::start() {
+#ifdef __linux__
+    if (m_leaderFd >= 0) {
+        ioctl(m_leaderFd, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+        ioctl(m_leaderFd, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+    }
+#endif
+    m_startTime = std::chrono::steady_clock::now();
+}
+
+PerfSample PerfCounters::stop() {
+    PerfSample sample;
+    sample.elapsedSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - m_startTime).count();
+#ifdef __linux__
+    if (m_leaderFd < 0) {
+        return sample;
+    }
+    ioctl(m_leaderFd, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+
+    // PERF_FORMAT_GROUP layout: nr, time_enabled, time_running, value[nr].
+    std::array<uint64_t, 3 + PERF_EVENT_COUNT> buffer{};
+    ssize_t expected = static_cast<ssize_t>((3 + m_groupSize) * sizeof(uint64_t));
+    if (read(m_leaderFd, buffer.data(), sizeof(buffer)) != expected || buffer[0] != m_groupSize) {
+        return sample;
+    }
+
+    uint64_t timeEnabled = buffer[1];
+    uint64_t timeRunning = buffer[2];
+    if (timeRunning == 0) {
+        return sample;
+    }
+    for (size_t i = 0; i < m_groupSize; ++i) {
+        double scaled = static_cast<double>(buffer[3 + i]) * static_cast<double>(timeEnabled) /
+                        static_cast<double>(timeRunning);
+        sample.counters[m_groupOrder[i]] = static_cast<uint64_t>(scaled);
+    }
+#endif
+    return sample;
+}
+
+const char* PerfCounters::getEventName(PerfEvent event) {
+    switch (event) {
+        case PerfEvent::Cycles:
+            return "cycles";
+        case PerfEvent::Instructions:
+            return "instructions";
+        case PerfEvent::BranchMisses:
+            return "branch-misses";
+        case PerfEvent::L1dMisses:
+            return "L1d-misses";
+        case PerfEvent::LlcMisses:
+            return "LLC-misses";
+    }
+    return "unknown";
+}
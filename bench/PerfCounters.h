@@ -0,0 +1,53 @@
+#pragma once
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <optional>
+#include <string>
+
+enum class PerfEvent {
+    Cycles,
+    Instructions,
+    BranchMisses,
+    L1dMisses,
+    LlcMisses
+};
+
+constexpr size_t PERF_EVENT_COUNT = 5;
+
+struct PerfSample {
+    double elapsedSeconds = 0.0;
+    std::array<std::optional<uint64_t>, PERF_EVENT_COUNT> counters{};
+
+    [[nodiscard]] std::optional<uint64_t> get(PerfEvent event) const {
+        return counters[static_cast<size_t>(event)];
+    }
+};
+
+// Wraps Linux perf_event_open. Events the kernel refuses (containers,
+// perf_event_paranoid, non-Linux hosts) are left empty and only the
+// wall-clock time is reported for them.
+class PerfCounters {
+public:
+    PerfCounters();
+    ~PerfCounters();
+
+    PerfCounters(const PerfCounters&) = delete;
+    PerfCounters& operator=(const PerfCounters&) = delete;
+
+    [[nodiscard]] bool available() const;
+    [[nodiscard]] const std::string& getUnavailableReason() const;
+
+    void start();
+    PerfSample stop();
+
+    static const char* getEventName(PerfEvent event);
+
+private:
+    std::array<int, PERF_EVENT_COUNT> m_fds;
+    std::array<size_t, PERF_EVENT_COUNT> m_groupOrder;
+    size_t m_groupSize;
+    int m_leaderFd;
+    std::string m_unavailableReason;
+    std::chrono::steady_clock::time_point m_startTime;
+};
@@ -0,0 +1,89 @@
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "BenchPrograms.h"
+#include "PerfCounters.h"
+#include "core/InstructionFactory.h"
+#include "core/ProgramImage.h"
+#include "core/VMContext.h"
+#include "core/VMLoader.h"
+
+static void printPhase(const std::string& phase, const PerfSample& sample, uint64_t units, const std::string& unitName) {
+    std::cout << "[" << phase << "] " << unitName << "s=" << units
+              << " time=" << std::fixed << std::setprecision(3) << sample.elapsedSeconds * 1e3 << "ms";
+    if (units > 0) {
+        std::cout << " ns/" << unitName << "=" << std::setprecision(2) << sample.elapsedSeconds * 1e9 / static_cast<double>(units);
+    }
+    std::cout << std::endl;
+
+    for (size_t i = 0; i < PERF_EVENT_COUNT; ++i) {
+        auto event = static_cast<PerfEvent>(i);
+        std::optional<uint64_t> value = sample.get(event);
+        if (!value) {
+            continue;
+        }
+        std::cout << "    " << std::left << std::setw(14) << PerfCounters::getEventName(event) << std::right
+                  << std::setw(14) << *value;
+        if (units > 0) {
+            std::cout << "  " << std::setprecision(4) << static_cast<double>(*value) / static_cast<double>(units)
+                      << " per " << unitName;
+        }
+        std::cout << std::endl;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    size_t repetitions = 50;
+    std::vector<uint32_t> rawCode = nestedLoopProgram();
+
+    try {
+        if (argc > 1) {
+            repetitions = std::stoull(argv[1]);
+        }
+        if (argc > 2) {
+            rawCode = VMLoader::loadBinaryFile(argv[2]);
+        }
+
+        PerfCounters counters;
+        if (!counters.available()) {
+            std::cout << "[perf] hardware counters unavailable (" << counters.getUnavailableReason()
+                      << "), reporting wall-clock time only" << std::endl;
+        } else if (!counters.getUnavailableReason().empty()) {
+            std::cout << "[perf] some counters unavailable (" << counters.getUnavailableReason() << ")" << std::endl;
+        }
+
+        InstructionFactory factory;
+        std::shared_ptr<const ProgramImage> image;
+
+        counters.start();
+        for (size_t i = 0; i < repetitions; ++i) {
+            image = std::make_shared<const ProgramImage>(factory.createProgram(rawCode));
+        }
+        PerfSample decodeSample = counters.stop();
+
+        std::ostream discard(nullptr);
+        uint64_t executed = 0;
+
+        counters.start();
+        for (size_t i = 0; i < repetitions; ++i) {
+            VMContext vm;
+            vm.setOutput(discard);
+            vm.loadProgram(image);
+            vm.run();
+            executed += vm.getExecutedCount();
+        }
+        PerfSample runSample = counters.stop();
+
+        std::cout << "program: " << rawCode.size() << " words, repetitions: " << repetitions << std::endl;
+        printPhase("decode", decodeSample, static_cast<uint64_t>(rawCode.size()) * repetitions, "word");
+        printPhase("run", runSample, executed, "vm-insn");
+    } catch (const std::exception& e) {
+        std::cerr << "[System Error] " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,76 @@
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "BenchPrograms.h"
+#include "core/InstructionFactory.h"
+#include "core/ProgramImage.h"
+#include "core/VMContext.h"
+#include "core/VMLoader.h"
+
+#ifdef __linux__
+#include <unistd.h>
+#endif
+
+static size_t residentBytes() {
+#ifdef __linux__
+    std::ifstream statm("/proc/self/statm");
+    size_t totalPages = 0;
+    size_t residentPages = 0;
+    if (statm >> totalPages >> residentPages) {
+        return residentPages * static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    }
+#endif
+    return 0;
+}
+
+int main(int argc, char* argv[]) {
+    size_t instanceCount = 1000000;
+    std::vector<uint32_t> rawCode = smallLoopProgram();
+
+    try {
+        if (argc > 1) {
+            instanceCount = std::stoull(argv[1]);
+        }
+        if (argc > 2) {
+            rawCode = VMLoader::loadBinaryFile(argv[2]);
+        }
+
+        InstructionFactory factory;
+        auto image = std::make_shared<const ProgramImage>(factory.createProgram(rawCode));
+
+        size_t baseline = residentBytes();
+        auto start = std::chrono::steady_clock::now();
+
+        std::vector<VMContext> instances;
+        instances.reserve(instanceCount);
+        for (size_t i = 0; i < instanceCount; ++i) {
+            instances.emplace_back();
+            instances.back().loadProgram(image);
+        }
+        for (VMContext& vm : instances) {
+            vm.run();
+        }
+
+        auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        size_t resident = residentBytes();
+
+        std::cout << "instances          : " << instanceCount << std::endl;
+        std::cout << "program size       : " << image->size() << " instructions (shared)" << std::endl;
+        std::cout << "sizeof(VMContext)  : " << sizeof(VMContext) << " bytes" << std::endl;
+        if (resident > baseline && instanceCount > 0) {
+            std::cout << "RSS per instance   : " << (resident - baseline) / instanceCount << " bytes" << std::endl;
+        } else {
+            std::cout << "RSS per instance   : unavailable" << std::endl;
+        }
+        std::cout << "create + run time  : " << elapsed << " s" << std::endl;
+    } catch (const std::exception& e) {
+        std::cerr << "[System Error] " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,81 @@
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "BenchPrograms.h"
+#include "PerfCounters.h"
+#include "core/InstructionFactory.h"
+#include "core/ProgramImage.h"
+#include "core/VMContext.h"
+
+// Steps one VM through the program and counts the PUSH/POP instructions it executes.
+static uint64_t countStackOps(const std::vector<uint32_t>& rawCode, const std::shared_ptr<const ProgramImage>& image) {
+    VMContext vm;
+    vm.loadProgram(image);
+    uint64_t stackOps = 0;
+    while (true) {
+        auto opcode = static_cast<OpCode>((rawCode[vm.getRegister(RegisterID::PC)] & 0xFF) >> 2);
+        if (!vm.step()) {
+            break;
+        }
+        if (opcode == OpCode::PUSH || opcode == OpCode::POP) {
+            stackOps++;
+        }
+    }
+    return stackOps;
+}
+
+int main(int argc, char* argv[]) {
+    size_t repetitions = 20000;
+
+    try {
+        if (argc > 1) {
+            repetitions = std::stoull(argv[1]);
+        }
+
+        std::vector<uint32_t> rawCode = stackChurnProgram();
+        InstructionFactory factory;
+        auto image = std::make_shared<const ProgramImage>(factory.createProgram(rawCode));
+        const uint64_t stackOps = countStackOps(rawCode, image) * repetitions;
+
+        PerfCounters counters;
+        uint64_t executed = 0;
+        uint64_t checksum = 0;
+
+        counters.start();
+        for (size_t i = 0; i < repetitions; ++i) {
+            VMContext vm;
+            vm.loadProgram(image);
+            vm.run();
+            executed += vm.getExecutedCount();
+            checksum += vm.getRegister(RegisterID::R2) + vm.getRegister(RegisterID::SP);
+        }
+        PerfSample sample = counters.stop();
+
+        std::cout << "repetitions: " << repetitions << " (checksum " << checksum << ")" << std::endl;
+        std::cout << "[push/pop churn] vm-insns=" << executed << " stack-ops=" << stackOps
+                  << " time=" << std::fixed << std::setprecision(3) << sample.elapsedSeconds * 1e3 << "ms"
+                  << " ns/vm-insn=" << std::setprecision(2) << sample.elapsedSeconds * 1e9 / static_cast<double>(executed)
+                  << " ns/stack-op=" << sample.elapsedSeconds * 1e9 / static_cast<double>(stackOps)
+                  << std::endl;
+
+        for (size_t i = 0; i < PERF_EVENT_COUNT; ++i) {
+            auto event = static_cast<PerfEvent>(i);
+            if (std::optional<uint64_t> value = sample.get(event)) {
+                std::cout << "    " << std::left << std::setw(14) << PerfCounters::getEventName(event) << std::right
+                          << std::setw(14) << *value << "  " << std::setprecision(4)
+                          << static_cast<double>(*value) / static_cast<double>(executed) << " per vm-insn" << std::endl;
+            }
+        }
+        if (!counters.available()) {
+            std::cout << "[perf] hardware counters unavailable, wall-clock time only" << std::endl;
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "[System Error] " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
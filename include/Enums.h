@@ -39,5 +39,6 @@ enum class FlagType : uint8_t {
 
 enum class ExecutionResult {
     Next,
-    Jumped
+    Jumped,
+    Break
 };
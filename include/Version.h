@@ -0,0 +1,3 @@
+#pragma once
+
+constexpr const char* VM_VERSION = "1.1.0";
@@ -0,0 +1,38 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+
+constexpr char BUNDLE_MAGIC[4] = {'V', 'M', 'B', 'N'};
+constexpr uint32_t BUNDLE_VERSION = 1;
+constexpr size_t BUNDLE_ALIGNMENT = 64;
+constexpr size_t BUNDLE_NAME_LENGTH = 48;
+
+// On-disk layout: BundleHeader, then entryCount BundleEntry records, then
+// program payloads, each starting on a BUNDLE_ALIGNMENT boundary.
+struct BundleHeader {
+    char magic[4];
+    uint32_t version;
+    uint32_t entryCount;
+    uint32_t indexOffset;
+};
+
+struct BundleEntry {
+    char name[BUNDLE_NAME_LENGTH];
+    uint32_t offset;
+    uint32_t length;
+    uint32_t checksum;
+    uint32_t reserved;
+};
+
+static_assert(sizeof(BundleHeader) == 16, "BundleHeader must be 16 bytes");
+static_assert(sizeof(BundleEntry) == 64, "BundleEntry must be 64 bytes");
+
+// FNV-1a over the raw program bytes; computed once by the packer and stored in the index.
+inline uint32_t bundleChecksum(const uint8_t* data, size_t length) {
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < length; ++i) {
+        hash ^= data[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
@@ -0,0 +1,27 @@
+#pragma once
+#include <istream>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include "core/Debugger.h"
+
+class DebugShell {
+public:
+    DebugShell(Debugger& debugger, std::istream& input, std::ostream& output);
+    void run();
+
+private:
+    bool execute(const std::string& command, std::istringstream& args);
+    void reportStop(StopReason reason);
+    void printRegisters();
+    void printStack();
+    void printInfo();
+    void printHelp();
+
+    static bool parseRegister(const std::string& name, uint8_t& regId);
+    static bool parseNumber(const std::string& text, uint8_t& value);
+
+    Debugger& m_debugger;
+    std::istream& m_input;
+    std::ostream& m_output;
+};
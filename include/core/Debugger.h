@@ -0,0 +1,61 @@
+#pragma once
+#include <set>
+#include <vector>
+#include <cstdint>
+#include "core/VMContext.h"
+#include "instructions/TrapInstruction.h"
+
+enum class StopReason {
+    Breakpoint,
+    Watchpoint,
+    Step,
+    Finished
+};
+
+enum class WatchTarget {
+    Register,
+    StackSlot
+};
+
+struct Watchpoint {
+    WatchTarget target;
+    uint8_t index;
+    uint8_t lastValue;
+    uint8_t previousValue;
+};
+
+class Debugger {
+public:
+    explicit Debugger(VMContext& vm);
+    ~Debugger();
+
+    Debugger(const Debugger&) = delete;
+    Debugger& operator=(const Debugger&) = delete;
+
+    void addBreakpoint(uint8_t pc);
+    void removeBreakpoint(uint8_t pc);
+    [[nodiscard]] const std::set<uint8_t>& getBreakpoints() const;
+
+    void addWatchpoint(WatchTarget target, uint8_t index);
+    void removeWatchpoint(WatchTarget target, uint8_t index);
+    [[nodiscard]] const std::vector<Watchpoint>& getWatchpoints() const;
+    [[nodiscard]] const Watchpoint* getTriggeredWatchpoint() const;
+
+    StopReason step();
+    StopReason resume();
+
+    [[nodiscard]] const VMContext& getContext() const;
+
+private:
+    [[nodiscard]] uint8_t readWatchTarget(const Watchpoint& watch) const;
+    [[nodiscard]] bool checkWatchpoints();
+    [[nodiscard]] bool isFinished() const;
+
+    VMContext& m_vm;
+    TrapInstruction m_trap;
+    std::vector<const IInstruction*> m_patchedTable;
+    std::set<uint8_t> m_breakpoints;
+    std::vector<Watchpoint> m_watchpoints;
+    int m_triggeredWatchpoint;
+    bool m_skipBreakpointAtPC;
+};
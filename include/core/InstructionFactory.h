@@ -19,6 +19,7 @@ public:
     std::vector<std::unique_ptr<IInstruction>> createProgram(
         const std::vector<uint32_t>& rawByteStream
     );
+    std::unique_ptr<IInstruction> createInstruction(uint32_t raw, int instructionIndex);
 
 private:
     static ParsedInstruction parseRaw(uint32_t raw);
@@ -0,0 +1,35 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include "core/BundleFormat.h"
+
+class ProgramBundle {
+public:
+    explicit ProgramBundle(const std::string& filePath);
+    ~ProgramBundle();
+
+    ProgramBundle(const ProgramBundle&) = delete;
+    ProgramBundle& operator=(const ProgramBundle&) = delete;
+
+    [[nodiscard]] size_t size() const;
+    [[nodiscard]] std::string getName(size_t index) const;
+    [[nodiscard]] size_t findIndex(const std::string& name) const;
+
+    std::vector<uint32_t> loadProgram(size_t index);
+    std::vector<uint32_t> loadProgram(const std::string& name);
+
+private:
+    void mapFile(const std::string& filePath);
+    void unmapFile();
+    void validateLayout() const;
+    [[nodiscard]] const BundleEntry& getEntry(size_t index) const;
+
+    const uint8_t* m_data = nullptr;
+    size_t m_size = 0;
+    std::vector<uint8_t> m_fallbackBuffer;
+    const BundleEntry* m_entries = nullptr;
+    size_t m_entryCount = 0;
+    std::vector<bool> m_verified;
+};
@@ -0,0 +1,48 @@
+#pragma once
+#include <vector>
+#include <memory>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <exception>
+#include <cstddef>
+#include "core/IInstruction.h"
+
+// Decoded program shared read-only by any number of VMContext instances.
+// A streamed image is append-only: published instructions never change and
+// readers block in waitFor() until later ones arrive or the stream ends.
+class ProgramImage {
+public:
+    explicit ProgramImage(std::vector<std::unique_ptr<IInstruction>> instructions);
+
+    ProgramImage(const ProgramImage&) = delete;
+    ProgramImage& operator=(const ProgramImage&) = delete;
+
+    static std::shared_ptr<ProgramImage> createStreaming();
+
+    void append(std::unique_ptr<IInstruction> instruction);
+    void finish(std::exception_ptr error = nullptr);
+
+    [[nodiscard]] size_t size() const;
+    [[nodiscard]] size_t waitFor(size_t index) const {
+        size_t available = m_size.load(std::memory_order_acquire);
+        return index < available ? available : waitForSlow(index);
+    }
+    [[nodiscard]] const IInstruction* const* getDispatchTable() const;
+    [[nodiscard]] const IInstruction* getInstruction(size_t index) const;
+
+    static constexpr size_t MAX_INSTRUCTIONS = 255;
+
+private:
+    ProgramImage();
+    [[nodiscard]] size_t waitForSlow(size_t index) const;
+
+    std::vector<std::unique_ptr<IInstruction>> m_instructions;
+    std::vector<const IInstruction*> m_dispatchTable;
+    std::atomic<size_t> m_size;
+    std::atomic<bool> m_complete;
+
+    mutable std::mutex m_mutex;
+    mutable std::condition_variable m_arrived;
+    std::exception_ptr m_error;
+};
@@ -0,0 +1,41 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <vector>
+
+struct CachedResult {
+    int exitStatus = 0;
+    std::string output;
+    std::string errorMessage;
+};
+
+struct CacheStats {
+    size_t hits = 0;
+    size_t misses = 0;
+    size_t stores = 0;
+    size_t evictions = 0;
+};
+
+class ResultCache {
+public:
+    ResultCache(std::string directory, uint64_t maxBytes);
+
+    [[nodiscard]] static std::string computeKey(const std::vector<uint32_t>& rawCode);
+
+    std::optional<CachedResult> lookup(const std::string& key);
+    void store(const std::string& key, const CachedResult& result);
+
+    [[nodiscard]] const CacheStats& getStats() const;
+
+    static constexpr uint64_t DEFAULT_MAX_BYTES = 64ull * 1024 * 1024;
+
+private:
+    [[nodiscard]] std::string entryPath(const std::string& key) const;
+    void evict();
+
+    std::string m_directory;
+    uint64_t m_maxBytes;
+    CacheStats m_stats;
+};
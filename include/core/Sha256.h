@@ -0,0 +1,22 @@
+#pragma once
+#include <array>
+#include <cstdint>
+#include <cstddef>
+#include <string>
+
+class Sha256 {
+public:
+    Sha256();
+    void update(const uint8_t* data, size_t length);
+    void update(const std::string& text);
+    std::array<uint8_t, 32> finish();
+    std::string finishHex();
+
+private:
+    void processBlock(const uint8_t* block);
+
+    std::array<uint32_t, 8> m_state;
+    std::array<uint8_t, 64> m_buffer;
+    size_t m_bufferLength;
+    uint64_t m_totalLength;
+};
@@ -0,0 +1,19 @@
+#pragma once
+#include <memory>
+#include <string>
+#include "core/ProgramImage.h"
+
+// Reads 4-byte instruction words from stdin ("-") or a pipe on a background
+// thread and decodes each one into a streaming ProgramImage as it arrives.
+class StreamLoader {
+public:
+    explicit StreamLoader(const std::string& source);
+
+    StreamLoader(const StreamLoader&) = delete;
+    StreamLoader& operator=(const StreamLoader&) = delete;
+
+    [[nodiscard]] std::shared_ptr<const ProgramImage> getImage() const;
+
+private:
+    std::shared_ptr<ProgramImage> m_image;
+};
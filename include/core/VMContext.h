@@ -2,14 +2,28 @@
 #include <vector>
 #include <array>
 #include <memory>
+#include <ostream>
 #include "Enums.h"
 #include "core/IInstruction.h"
+#include "core/ProgramImage.h"
 
-class VMContext {
+constexpr size_t CACHE_LINE_SIZE = 64;
+
+class alignas(CACHE_LINE_SIZE) VMContext {
 public:
     VMContext();
     void loadProgram(std::vector<std::unique_ptr<IInstruction>> program);
+    void loadProgram(std::shared_ptr<const ProgramImage> image);
     void run();
+    bool step();
+
+    [[nodiscard]] const std::shared_ptr<const ProgramImage>& getProgram() const;
+    void setDispatchTable(const IInstruction* const* dispatchTable);
+
+    [[nodiscard]] uint64_t getExecutedCount() const;
+
+    void setOutput(std::ostream& output);
+    [[nodiscard]] std::ostream& getOutput() const;
 
     [[nodiscard]] uint8_t getRegister(uint8_t regId) const;
     [[nodiscard]] uint8_t getRegister(RegisterID regId) const;
@@ -19,8 +33,25 @@ public:
     [[nodiscard]] bool getFlag(RegisterID flag) const;
     void setFlag(RegisterID flag, bool value);
 
-    void pushStack(uint8_t value);
-    uint8_t popStack();
+    // Defined inline and on the SP slot directly, so PUSH/POP skip the
+    // register bounds checks and the call into setRegisterInternal.
+    void pushStack(uint8_t value) {
+        uint8_t& sp = m_registers[static_cast<uint8_t>(RegisterID::SP)];
+        if (sp == 0) {
+            throwStackOverflow();
+        }
+        sp--;
+        m_stackMemory[sp] = value;
+    }
+    uint8_t popStack() {
+        uint8_t& sp = m_registers[static_cast<uint8_t>(RegisterID::SP)];
+        if (sp == STACK_SIZE - 1) {
+            throwStackUnderflow();
+        }
+        return m_stackMemory[sp++];
+    }
+
+    [[nodiscard]] uint8_t readStackSlot(uint8_t address) const;
 
     void incrementPC();
     void setPC(uint8_t address);
@@ -33,7 +64,15 @@ public:
 
 private:
     void setRegisterInternal(RegisterID regId, uint8_t value);
+    bool dispatch(const IInstruction* const* dispatchTable, size_t instructionCount);
+    [[noreturn]] static void throwStackOverflow();
+    [[noreturn]] static void throwStackUnderflow();
+    [[nodiscard]] size_t programSize() const;
+
+    std::shared_ptr<const ProgramImage> m_program;
+    const IInstruction* const* m_dispatchTable;
+    std::ostream* m_output;
+    uint64_t m_executedCount;
     std::array<uint8_t, REGISTER_COUNT> m_registers;
     std::array<uint8_t, STACK_SIZE> m_stackMemory;
-    std::vector<std::unique_ptr<IInstruction>> m_program;
 };
@@ -5,5 +5,5 @@
 class AddInstruction : public IInstruction {
 public:
     AddInstruction(uint8_t flag, uint8_t src, uint8_t dest);
-    ExecutionResult execute(VMContext& context) override;
+    ExecutionResult execute(VMContext& context) const override;
 };
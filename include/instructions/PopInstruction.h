@@ -5,5 +5,5 @@
 class PopInstruction : public IInstruction {
 public:
     PopInstruction(uint8_t flag, uint8_t src, uint8_t dest);
-    ExecutionResult execute(VMContext& context) override;
+    ExecutionResult execute(VMContext& context) const override;
 };
@@ -0,0 +1,11 @@
+#pragma once
+#include "core/IInstruction.h"
+#include <cstdint>
+
+// Not part of the ISA: patched into a debugger's dispatch table in place of
+// the instruction at a breakpoint so that VMContext::run stops there.
+class TrapInstruction : public IInstruction {
+public:
+    TrapInstruction();
+    ExecutionResult execute(VMContext& context) const override;
+};
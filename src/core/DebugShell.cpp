@@ -0,0 +1,198 @@
+#include "core/DebugShell.h"
+#include "core/VMException.h"
+#include <array>
+#include <stdexcept>
+
+namespace {
+
+constexpr std::array<const char*, REGISTER_COUNT> REGISTER_NAMES = {
+    "", "R0", "R1", "R2", "PC", "SP", "BP", "ZF", "CF", "OF"
+};
+
+std::string describeWatch(const Watchpoint& watch) {
+    if (watch.target == WatchTarget::Register) {
+        return REGISTER_NAMES[watch.index];
+    }
+    return "stack[" + std::to_string(watch.index) + "]";
+}
+
+}
+
+DebugShell::DebugShell(Debugger& debugger, std::istream& input, std::ostream& output)
+    : m_debugger(debugger), m_input(input), m_output(output) {}
+
+void DebugShell::run() {
+    std::string line;
+    while (true) {
+        m_output << "(vmdb) " << std::flush;
+        if (!std::getline(m_input, line)) {
+            break;
+        }
+
+        std::istringstream args(line);
+        std::string command;
+        if (!(args >> command)) {
+            continue;
+        }
+
+        try {
+            if (!execute(command, args)) {
+                break;
+            }
+        } catch (const VMException& e) {
+            m_output << "[VM Error] " << e.getFullMessage() << std::endl;
+        } catch (const std::exception& e) {
+            m_output << e.what() << std::endl;
+        }
+    }
+}
+
+bool DebugShell::execute(const std::string& command, std::istringstream& args) {
+    std::string first;
+    std::string second;
+    args >> first >> second;
+    uint8_t value = 0;
+
+    if (command == "quit" || command == "q") {
+        return false;
+    } else if (command == "help" || command == "h") {
+        printHelp();
+    } else if (command == "break" || command == "b") {
+        if (!parseNumber(first, value)) {
+            throw std::runtime_error("Usage: break <pc>");
+        }
+        m_debugger.addBreakpoint(value);
+        m_output << "Breakpoint set at [" << static_cast<int>(value) << "]" << std::endl;
+    } else if (command == "delete" || command == "d") {
+        if (!parseNumber(first, value)) {
+            throw std::runtime_error("Usage: delete <pc>");
+        }
+        m_debugger.removeBreakpoint(value);
+        m_output << "Breakpoint removed at [" << static_cast<int>(value) << "]" << std::endl;
+    } else if (command == "watch" || command == "unwatch") {
+        WatchTarget target = WatchTarget::Register;
+        bool valid = parseRegister(first, value);
+        if (!valid && first == "stack") {
+            target = WatchTarget::StackSlot;
+            valid = parseNumber(second, value);
+        }
+        if (!valid) {
+            throw std::runtime_error("Usage: " + command + " <register> | " + command + " stack <slot>");
+        }
+        if (command == "watch") {
+            m_debugger.addWatchpoint(target, value);
+        } else {
+            m_debugger.removeWatchpoint(target, value);
+        }
+    } else if (command == "step" || command == "s") {
+        uint8_t count = 1;
+        if (!first.empty() && (!parseNumber(first, count) || count == 0)) {
+            throw std::runtime_error("Usage: step [n] (1-255)");
+        }
+        StopReason reason = StopReason::Step;
+        for (uint8_t i = 0; i < count && reason == StopReason::Step; ++i) {
+            reason = m_debugger.step();
+        }
+        reportStop(reason);
+    } else if (command == "continue" || command == "c" || command == "run" || command == "r") {
+        reportStop(m_debugger.resume());
+    } else if (command == "regs") {
+        printRegisters();
+    } else if (command == "stack") {
+        printStack();
+    } else if (command == "info") {
+        printInfo();
+    } else {
+        throw std::runtime_error("Unknown command: " + command + " (type 'help')");
+    }
+    return true;
+}
+
+void DebugShell::reportStop(StopReason reason) {
+    int pc = m_debugger.getContext().getRegister(RegisterID::PC);
+    switch (reason) {
+        case StopReason::Breakpoint:
+            m_output << "Breakpoint hit at [" << pc << "]" << std::endl;
+            break;
+        case StopReason::Watchpoint: {
+            const Watchpoint* watch = m_debugger.getTriggeredWatchpoint();
+            m_output << "Watchpoint " << describeWatch(*watch) << ": "
+                     << static_cast<int>(watch->previousValue) << " -> " << static_cast<int>(watch->lastValue)
+                     << ", stopped at [" << pc << "]" << std::endl;
+            break;
+        }
+        case StopReason::Step:
+            m_output << "Stopped at [" << pc << "]" << std::endl;
+            break;
+        case StopReason::Finished:
+            m_output << "Program finished." << std::endl;
+            break;
+    }
+}
+
+void DebugShell::printRegisters() {
+    const VMContext& vm = m_debugger.getContext();
+    for (uint8_t id = 1; id < REGISTER_COUNT; ++id) {
+        m_output << REGISTER_NAMES[id] << "=" << static_cast<int>(vm.getRegister(id))
+                 << (static_cast<size_t>(id) + 1 < REGISTER_COUNT ? " " : "\n");
+    }
+    m_output << std::flush;
+}
+
+void DebugShell::printStack() {
+    const VMContext& vm = m_debugger.getContext();
+    uint8_t sp = vm.getRegister(RegisterID::SP);
+    if (sp >= VMContext::STACK_SIZE - 1) {
+        m_output << "(empty)" << std::endl;
+        return;
+    }
+    for (size_t address = sp; address < VMContext::STACK_SIZE - 1; ++address) {
+        m_output << "[" << address << "] " << static_cast<int>(vm.readStackSlot(static_cast<uint8_t>(address))) << std::endl;
+    }
+}
+
+void DebugShell::printInfo() {
+    m_output << "Breakpoints:";
+    for (uint8_t pc : m_debugger.getBreakpoints()) {
+        m_output << " [" << static_cast<int>(pc) << "]";
+    }
+    m_output << std::endl << "Watchpoints:";
+    for (const Watchpoint& watch : m_debugger.getWatchpoints()) {
+        m_output << " " << describeWatch(watch) << "=" << static_cast<int>(watch.lastValue);
+    }
+    m_output << std::endl;
+}
+
+void DebugShell::printHelp() {
+    m_output << "break <pc>            Set a breakpoint\n"
+             << "delete <pc>           Remove a breakpoint\n"
+             << "watch <reg>           Stop when a register changes\n"
+             << "watch stack <slot>    Stop when a stack slot changes\n"
+             << "unwatch <reg|stack n> Remove a watchpoint\n"
+             << "step [n]              Execute n instructions\n"
+             << "continue              Run until a breakpoint, watchpoint or the end\n"
+             << "regs / stack / info   Inspect registers, stack, breakpoints\n"
+             << "quit                  Leave the debugger" << std::endl;
+}
+
+bool DebugShell::parseRegister(const std::string& name, uint8_t& regId) {
+    for (uint8_t id = 1; id < REGISTER_COUNT; ++id) {
+        if (name == REGISTER_NAMES[id]) {
+            regId = id;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool DebugShell::parseNumber(const std::string& text, uint8_t& value) {
+    if (text.empty() || text.find_first_not_of("0123456789") != std::string::npos || text.size() > 3) {
+        return false;
+    }
+    int parsed = std::stoi(text);
+    if (parsed > 255) {
+        return false;
+    }
+    value = static_cast<uint8_t>(parsed);
+    return true;
+}
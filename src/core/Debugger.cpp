@@ -0,0 +1,159 @@
+#include "core/Debugger.h"
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+
+Debugger::Debugger(VMContext& vm)
+    : m_vm(vm), m_trap(), m_triggeredWatchpoint(-1), m_skipBreakpointAtPC(false) {}
+
+Debugger::~Debugger() {
+    if (!m_patchedTable.empty()) {
+        m_vm.setDispatchTable(nullptr);
+    }
+}
+
+void Debugger::addBreakpoint(uint8_t pc) {
+    const auto& program = m_vm.getProgram();
+    if (!program || pc >= program->size()) {
+        throw std::runtime_error("Invalid Breakpoint Address: " + std::to_string(pc));
+    }
+
+    if (m_patchedTable.empty()) {
+        const IInstruction* const* original = program->getDispatchTable();
+        m_patchedTable.assign(original, original + program->size());
+        m_vm.setDispatchTable(m_patchedTable.data());
+    }
+
+    m_patchedTable[pc] = &m_trap;
+    m_breakpoints.insert(pc);
+}
+
+void Debugger::removeBreakpoint(uint8_t pc) {
+    if (m_breakpoints.erase(pc) == 0) {
+        throw std::runtime_error("No breakpoint at address " + std::to_string(pc));
+    }
+
+    m_patchedTable[pc] = m_vm.getProgram()->getInstruction(pc);
+
+    if (m_breakpoints.empty()) {
+        m_vm.setDispatchTable(nullptr);
+        m_patchedTable.clear();
+    }
+}
+
+const std::set<uint8_t>& Debugger::getBreakpoints() const {
+    return m_breakpoints;
+}
+
+void Debugger::addWatchpoint(WatchTarget target, uint8_t index) {
+    if (target == WatchTarget::Register && (index == 0 || index >= REGISTER_COUNT)) {
+        throw std::runtime_error("Invalid Watch Register: " + std::to_string(index));
+    }
+
+    for (const Watchpoint& watch : m_watchpoints) {
+        if (watch.target == target && watch.index == index) {
+            return;
+        }
+    }
+
+    Watchpoint watch{target, index, 0, 0};
+    watch.lastValue = readWatchTarget(watch);
+    watch.previousValue = watch.lastValue;
+    m_watchpoints.push_back(watch);
+}
+
+void Debugger::removeWatchpoint(WatchTarget target, uint8_t index) {
+    auto it = std::find_if(m_watchpoints.begin(), m_watchpoints.end(), [&](const Watchpoint& watch) {
+        return watch.target == target && watch.index == index;
+    });
+    if (it == m_watchpoints.end()) {
+        throw std::runtime_error("No watchpoint on " + std::to_string(index));
+    }
+    m_watchpoints.erase(it);
+    m_triggeredWatchpoint = -1;
+}
+
+const std::vector<Watchpoint>& Debugger::getWatchpoints() const {
+    return m_watchpoints;
+}
+
+const Watchpoint* Debugger::getTriggeredWatchpoint() const {
+    if (m_triggeredWatchpoint < 0) {
+        return nullptr;
+    }
+    return &m_watchpoints[static_cast<size_t>(m_triggeredWatchpoint)];
+}
+
+StopReason Debugger::step() {
+    m_triggeredWatchpoint = -1;
+    if (isFinished()) {
+        return StopReason::Finished;
+    }
+
+    m_vm.step();
+    m_skipBreakpointAtPC = true;
+
+    if (checkWatchpoints()) {
+        return StopReason::Watchpoint;
+    }
+    return isFinished() ? StopReason::Finished : StopReason::Step;
+}
+
+StopReason Debugger::resume() {
+    m_triggeredWatchpoint = -1;
+    if (isFinished()) {
+        return StopReason::Finished;
+    }
+
+    if (m_skipBreakpointAtPC && m_breakpoints.count(m_vm.getRegister(RegisterID::PC)) != 0) {
+        StopReason reason = step();
+        if (reason != StopReason::Step) {
+            return reason;
+        }
+    }
+
+    if (m_watchpoints.empty()) {
+        m_vm.run();
+    } else {
+        while (!isFinished() && m_breakpoints.count(m_vm.getRegister(RegisterID::PC)) == 0) {
+            m_vm.step();
+            if (checkWatchpoints()) {
+                m_skipBreakpointAtPC = true;
+                return StopReason::Watchpoint;
+            }
+        }
+    }
+
+    m_skipBreakpointAtPC = true;
+    return isFinished() ? StopReason::Finished : StopReason::Breakpoint;
+}
+
+const VMContext& Debugger::getContext() const {
+    return m_vm;
+}
+
+uint8_t Debugger::readWatchTarget(const Watchpoint& watch) const {
+    if (watch.target == WatchTarget::Register) {
+        return m_vm.getRegister(watch.index);
+    }
+    return m_vm.readStackSlot(watch.index);
+}
+
+bool Debugger::checkWatchpoints() {
+    for (size_t i = 0; i < m_watchpoints.size(); ++i) {
+        uint8_t value = readWatchTarget(m_watchpoints[i]);
+        if (value != m_watchpoints[i].lastValue) {
+            m_watchpoints[i].previousValue = m_watchpoints[i].lastValue;
+            m_watchpoints[i].lastValue = value;
+            if (m_triggeredWatchpoint < 0) {
+                m_triggeredWatchpoint = static_cast<int>(i);
+            }
+        }
+    }
+    return m_triggeredWatchpoint >= 0;
+}
+
+bool Debugger::isFinished() const {
+    const auto& program = m_vm.getProgram();
+    return !program || m_vm.getRegister(RegisterID::PC) >= program->size();
+}
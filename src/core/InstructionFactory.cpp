@@ -129,29 +129,32 @@ std::vector<std::unique_ptr<IInstruction>> InstructionFactory::createProgram(
     program.reserve(rawByteStream.size());
 
     for (size_t i = 0; i < rawByteStream.size(); ++i) {
-        uint32_t raw = rawByteStream[i];
-        ParsedInstruction parsed = parseRaw(raw);
+        program.push_back(createInstruction(rawByteStream[i], static_cast<int>(i)));
+    }
 
-        auto it = m_registry.find(parsed.opcode);
-        if (it == m_registry.end()) {
-            throw VMException("Unknown Opcode: " + std::to_string(parsed.opcode), static_cast<int>(i));
-        }
+    return program;
+}
 
-        if (!isValidFlag(static_cast<OpCode>(parsed.opcode), parsed.flag)) {
-            throw VMException(
-                "Invalid Flag (" + std::to_string(parsed.flag) +
-                ") for Opcode " + std::to_string(parsed.opcode),
-                static_cast<int>(i)
-            );
-        }
+std::unique_ptr<IInstruction> InstructionFactory::createInstruction(uint32_t raw, int instructionIndex) {
+    ParsedInstruction parsed = parseRaw(raw);
 
-        validateOperands(static_cast<FlagType>(parsed.flag), parsed.src, parsed.dest, static_cast<int>(i));
+    auto it = m_registry.find(parsed.opcode);
+    if (it == m_registry.end()) {
+        throw VMException("Unknown Opcode: " + std::to_string(parsed.opcode), instructionIndex);
+    }
 
-        CreateFunc& creator = it->second;
-        program.push_back(creator(parsed.flag, parsed.src, parsed.dest));
+    if (!isValidFlag(static_cast<OpCode>(parsed.opcode), parsed.flag)) {
+        throw VMException(
+            "Invalid Flag (" + std::to_string(parsed.flag) +
+            ") for Opcode " + std::to_string(parsed.opcode),
+            instructionIndex
+        );
     }
 
-    return program;
+    validateOperands(static_cast<FlagType>(parsed.flag), parsed.src, parsed.dest, instructionIndex);
+
+    CreateFunc& creator = it->second;
+    return creator(parsed.flag, parsed.src, parsed.dest);
 }
 
 ParsedInstruction InstructionFactory::parseRaw(uint32_t raw) {
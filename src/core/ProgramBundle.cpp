@@ -0,0 +1,154 @@
+#include "core/ProgramBundle.h"
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+ProgramBundle::ProgramBundle(const std::string& filePath) {
+    mapFile(filePath);
+    try {
+        validateLayout();
+    } catch (...) {
+        unmapFile();
+        throw;
+    }
+
+    const auto* header = reinterpret_cast<const BundleHeader*>(m_data);
+    m_entries = reinterpret_cast<const BundleEntry*>(m_data + header->indexOffset);
+    m_entryCount = header->entryCount;
+    m_verified.assign(m_entryCount, false);
+}
+
+ProgramBundle::~ProgramBundle() {
+    unmapFile();
+}
+
+void ProgramBundle::mapFile(const std::string& filePath) {
+#ifndef _WIN32
+    int fd = open(filePath.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw std::runtime_error("Error: Cannot open bundle " + filePath);
+    }
+
+    struct stat st{};
+    if (fstat(fd, &st) != 0) {
+        close(fd);
+        throw std::runtime_error("Error: Cannot stat bundle " + filePath);
+    }
+    m_size = static_cast<size_t>(st.st_size);
+
+    if (m_size > 0) {
+        void* mapped = mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (mapped == MAP_FAILED) {
+            close(fd);
+            throw std::runtime_error("Error: Failed to map bundle " + filePath);
+        }
+        m_data = static_cast<const uint8_t*>(mapped);
+    }
+    close(fd);
+#else
+    std::ifstream file(filePath, std::ios::binary | std::ios::ate);
+    if (!file.is_open()) {
+        throw std::runtime_error("Error: Cannot open bundle " + filePath);
+    }
+    m_size = static_cast<size_t>(file.tellg());
+    file.seekg(0, std::ios::beg);
+    m_fallbackBuffer.resize(m_size);
+    if (m_size > 0 && !file.read(reinterpret_cast<char*>(m_fallbackBuffer.data()), static_cast<std::streamsize>(m_size))) {
+        throw std::runtime_error("Error: Failed to read bundle " + filePath);
+    }
+    m_data = m_fallbackBuffer.data();
+#endif
+}
+
+void ProgramBundle::unmapFile() {
+#ifndef _WIN32
+    if (m_data != nullptr) {
+        munmap(const_cast<uint8_t*>(m_data), m_size);
+    }
+#endif
+    m_data = nullptr;
+    m_size = 0;
+}
+
+void ProgramBundle::validateLayout() const {
+    if (m_size < sizeof(BundleHeader)) {
+        throw std::runtime_error("Error: Bundle is too small to contain a header.");
+    }
+
+    const auto* header = reinterpret_cast<const BundleHeader*>(m_data);
+    if (std::memcmp(header->magic, BUNDLE_MAGIC, sizeof(BUNDLE_MAGIC)) != 0) {
+        throw std::runtime_error("Error: Not a program bundle (bad magic).");
+    }
+    if (header->version != BUNDLE_VERSION) {
+        throw std::runtime_error("Error: Unsupported bundle version " + std::to_string(header->version));
+    }
+
+    uint64_t indexEnd = static_cast<uint64_t>(header->indexOffset) +
+                        static_cast<uint64_t>(header->entryCount) * sizeof(BundleEntry);
+    if (header->indexOffset % alignof(BundleEntry) != 0 || indexEnd > m_size) {
+        throw std::runtime_error("Error: Bundle index is out of bounds.");
+    }
+
+    const auto* entries = reinterpret_cast<const BundleEntry*>(m_data + header->indexOffset);
+    for (uint32_t i = 0; i < header->entryCount; ++i) {
+        const BundleEntry& entry = entries[i];
+        uint64_t payloadEnd = static_cast<uint64_t>(entry.offset) + entry.length;
+        if (payloadEnd > m_size || entry.length % 4 != 0) {
+            throw std::runtime_error("Error: Bundle entry " + std::to_string(i) + " has an invalid payload range.");
+        }
+    }
+}
+
+size_t ProgramBundle::size() const {
+    return m_entryCount;
+}
+
+const BundleEntry& ProgramBundle::getEntry(size_t index) const {
+    if (index >= m_entryCount) {
+        throw std::runtime_error("Error: Bundle index out of range: " + std::to_string(index));
+    }
+    return m_entries[index];
+}
+
+std::string ProgramBundle::getName(size_t index) const {
+    const BundleEntry& entry = getEntry(index);
+    return std::string(entry.name, strnlen(entry.name, BUNDLE_NAME_LENGTH));
+}
+
+size_t ProgramBundle::findIndex(const std::string& name) const {
+    for (size_t i = 0; i < m_entryCount; ++i) {
+        if (getName(i) == name) {
+            return i;
+        }
+    }
+    throw std::runtime_error("Error: No program named " + name + " in bundle.");
+}
+
+std::vector<uint32_t> ProgramBundle::loadProgram(size_t index) {
+    const BundleEntry& entry = getEntry(index);
+    const uint8_t* payload = m_data + entry.offset;
+
+    if (!m_verified[index]) {
+        if (bundleChecksum(payload, entry.length) != entry.checksum) {
+            throw std::runtime_error("Error: Checksum mismatch for bundled program " + getName(index));
+        }
+        m_verified[index] = true;
+    }
+
+    std::vector<uint32_t> rawProgram(entry.length / 4);
+    if (entry.length > 0) {
+        std::memcpy(rawProgram.data(), payload, entry.length);
+    }
+    return rawProgram;
+}
+
+std::vector<uint32_t> ProgramBundle::loadProgram(const std::string& name) {
+    return loadProgram(findIndex(name));
+}
@@ -0,0 +1,86 @@
+#include "core/ProgramImage.h"
+#include <stdexcept>
+#include <string>
+
+ProgramImage::ProgramImage(std::vector<std::unique_ptr<IInstruction>> instructions)
+    : m_instructions(std::move(instructions)), m_size(0), m_complete(true) {
+    if (m_instructions.size() > MAX_INSTRUCTIONS) {
+        throw std::runtime_error("Program too large: Max 255 instructions allowed.");
+    }
+
+    m_dispatchTable.reserve(m_instructions.size());
+    for (size_t i = 0; i < m_instructions.size(); ++i) {
+        if (!m_instructions[i]) {
+            throw std::runtime_error("Null instruction pointer encountered at index " + std::to_string(i));
+        }
+        m_dispatchTable.push_back(m_instructions[i].get());
+    }
+    m_size.store(m_dispatchTable.size(), std::memory_order_release);
+}
+
+ProgramImage::ProgramImage() : m_size(0), m_complete(false) {
+    m_instructions.reserve(MAX_INSTRUCTIONS);
+    m_dispatchTable.reserve(MAX_INSTRUCTIONS);
+}
+
+std::shared_ptr<ProgramImage> ProgramImage::createStreaming() {
+    return std::shared_ptr<ProgramImage>(new ProgramImage());
+}
+
+void ProgramImage::append(std::unique_ptr<IInstruction> instruction) {
+    if (m_complete.load(std::memory_order_acquire)) {
+        throw std::runtime_error("Error: Cannot append to a finished program.");
+    }
+    if (m_instructions.size() >= MAX_INSTRUCTIONS) {
+        throw std::runtime_error("Program too large: Max 255 instructions allowed.");
+    }
+    if (!instruction) {
+        throw std::runtime_error("Null instruction pointer encountered at index " + std::to_string(m_instructions.size()));
+    }
+
+    // Capacity is reserved up front, so the dispatch table never moves under a running VM.
+    m_dispatchTable.push_back(instruction.get());
+    m_instructions.push_back(std::move(instruction));
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_size.store(m_dispatchTable.size(), std::memory_order_release);
+    }
+    m_arrived.notify_all();
+}
+
+void ProgramImage::finish(std::exception_ptr error) {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_error = std::move(error);
+        m_complete.store(true, std::memory_order_release);
+    }
+    m_arrived.notify_all();
+}
+
+size_t ProgramImage::size() const {
+    return m_size.load(std::memory_order_acquire);
+}
+
+size_t ProgramImage::waitForSlow(size_t index) const {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_arrived.wait(lock, [&] {
+        return index < m_size.load(std::memory_order_acquire) || m_complete.load(std::memory_order_acquire);
+    });
+
+    size_t available = m_size.load(std::memory_order_acquire);
+    if (index >= available && m_error) {
+        std::rethrow_exception(m_error);
+    }
+    return available;
+}
+
+const IInstruction* const* ProgramImage::getDispatchTable() const {
+    return m_dispatchTable.data();
+}
+
+const IInstruction* ProgramImage::getInstruction(size_t index) const {
+    if (index >= size()) {
+        throw std::runtime_error("Error: Instruction index out of range: " + std::to_string(index));
+    }
+    return m_dispatchTable[index];
+}
@@ -0,0 +1,194 @@
+#include "core/ResultCache.h"
+#include "core/Sha256.h"
+#include "core/VMContext.h"
+#include "Version.h"
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <stdexcept>
+
+namespace fs = std::filesystem;
+
+namespace {
+
+constexpr char ENTRY_MAGIC[4] = {'V', 'M', 'R', 'C'};
+constexpr uint32_t ENTRY_FORMAT_VERSION = 1;
+constexpr const char* ENTRY_EXTENSION = ".vmr";
+constexpr const char* TEMP_MARKER = ".vmr.tmp.";
+// Temp files older than this belong to a writer that died before rename.
+constexpr auto STALE_TEMP_AGE = std::chrono::minutes(5);
+
+struct EntryHeader {
+    char magic[4];
+    uint32_t formatVersion;
+    int32_t exitStatus;
+    uint32_t outputLength;
+    uint32_t errorLength;
+};
+
+std::string uniqueSuffix() {
+    static std::random_device device;
+    static std::mt19937_64 generator(device());
+    return std::to_string(generator());
+}
+
+}
+
+ResultCache::ResultCache(std::string directory, uint64_t maxBytes)
+    : m_directory(std::move(directory)), m_maxBytes(maxBytes), m_stats{} {
+    std::error_code ec;
+    fs::create_directories(m_directory, ec);
+    if (!fs::is_directory(m_directory, ec)) {
+        throw std::runtime_error("Error: Cannot create cache directory " + m_directory);
+    }
+}
+
+std::string ResultCache::computeKey(const std::vector<uint32_t>& rawCode) {
+    Sha256 hash;
+    hash.update(std::string("vm=") + VM_VERSION +
+                ";stack=" + std::to_string(VMContext::STACK_SIZE) +
+                ";registers=" + std::to_string(REGISTER_COUNT) + ";");
+    hash.update(reinterpret_cast<const uint8_t*>(rawCode.data()), rawCode.size() * sizeof(uint32_t));
+    return hash.finishHex();
+}
+
+std::string ResultCache::entryPath(const std::string& key) const {
+    return (fs::path(m_directory) / (key + ENTRY_EXTENSION)).string();
+}
+
+std::optional<CachedResult> ResultCache::lookup(const std::string& key) {
+    std::string path = entryPath(key);
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open()) {
+        m_stats.misses++;
+        return std::nullopt;
+    }
+
+    std::error_code sizeEc;
+    uint64_t fileSize = fs::file_size(path, sizeEc);
+
+    EntryHeader header{};
+    CachedResult result;
+    bool valid = !sizeEc && static_cast<bool>(file.read(reinterpret_cast<char*>(&header), sizeof(header))) &&
+                 std::memcmp(header.magic, ENTRY_MAGIC, sizeof(ENTRY_MAGIC)) == 0 &&
+                 header.formatVersion == ENTRY_FORMAT_VERSION &&
+                 sizeof(header) + uint64_t{header.outputLength} + header.errorLength == fileSize;
+    if (valid) {
+        result.exitStatus = header.exitStatus;
+        result.output.resize(header.outputLength);
+        result.errorMessage.resize(header.errorLength);
+        valid = file.read(result.output.data(), header.outputLength) &&
+                file.read(result.errorMessage.data(), header.errorLength);
+    }
+    file.close();
+
+    std::error_code ec;
+    if (!valid) {
+        fs::remove(path, ec);
+        m_stats.misses++;
+        return std::nullopt;
+    }
+
+    fs::last_write_time(path, fs::file_time_type::clock::now(), ec);
+    m_stats.hits++;
+    return result;
+}
+
+void ResultCache::store(const std::string& key, const CachedResult& result) {
+    std::string finalPath = entryPath(key);
+    std::string tempPath = (fs::path(m_directory) / (key + TEMP_MARKER + uniqueSuffix())).string();
+
+    EntryHeader header{};
+    std::memcpy(header.magic, ENTRY_MAGIC, sizeof(ENTRY_MAGIC));
+    header.formatVersion = ENTRY_FORMAT_VERSION;
+    header.exitStatus = result.exitStatus;
+    header.outputLength = static_cast<uint32_t>(result.output.size());
+    header.errorLength = static_cast<uint32_t>(result.errorMessage.size());
+
+    {
+        std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+        if (!file.is_open()) {
+            return;
+        }
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(result.output.data(), static_cast<std::streamsize>(result.output.size()));
+        file.write(result.errorMessage.data(), static_cast<std::streamsize>(result.errorMessage.size()));
+        if (!file.flush()) {
+            file.close();
+            std::error_code ec;
+            fs::remove(tempPath, ec);
+            return;
+        }
+    }
+
+    std::error_code ec;
+    fs::rename(tempPath, finalPath, ec);
+    if (ec) {
+        fs::remove(tempPath, ec);
+        return;
+    }
+    m_stats.stores++;
+    evict();
+}
+
+void ResultCache::evict() {
+    struct Entry {
+        fs::path path;
+        uint64_t size;
+        fs::file_time_type lastUsed;
+    };
+
+    std::vector<Entry> entries;
+    uint64_t totalBytes = 0;
+    const fs::file_time_type staleBefore = fs::file_time_type::clock::now() - STALE_TEMP_AGE;
+    std::error_code ec;
+    for (fs::directory_iterator it(m_directory, ec), end; !ec && it != end; it.increment(ec)) {
+        bool isEntry = it->path().extension() == ENTRY_EXTENSION;
+        bool isTemp = it->path().filename().string().find(TEMP_MARKER) != std::string::npos;
+        if (!isEntry && !isTemp) {
+            continue;
+        }
+        std::error_code entryEc;
+        uint64_t size = it->file_size(entryEc);
+        fs::file_time_type lastUsed = it->last_write_time(entryEc);
+        if (entryEc) {
+            continue;
+        }
+        if (isTemp) {
+            // A fresh temp file may still be renamed by its writer; a stale one never will.
+            std::error_code removeEc;
+            if (lastUsed >= staleBefore || !fs::remove(it->path(), removeEc)) {
+                totalBytes += size;
+            }
+            continue;
+        }
+        entries.push_back({it->path(), size, lastUsed});
+        totalBytes += size;
+    }
+
+    if (totalBytes <= m_maxBytes) {
+        return;
+    }
+
+    std::sort(entries.begin(), entries.end(), [](const Entry& a, const Entry& b) {
+        return a.lastUsed < b.lastUsed;
+    });
+
+    for (const Entry& entry : entries) {
+        if (totalBytes <= m_maxBytes) {
+            break;
+        }
+        std::error_code removeEc;
+        if (fs::remove(entry.path, removeEc)) {
+            m_stats.evictions++;
+        }
+        totalBytes -= entry.size;
+    }
+}
+
+const CacheStats& ResultCache::getStats() const {
+    return m_stats;
+}
@@ -0,0 +1,75 @@
+#include "core/StreamLoader.h"
+#include "core/InstructionFactory.h"
+#include "core/VMException.h"
+#include <cstdio>
+#include <stdexcept>
+#include <thread>
+
+#ifdef _WIN32
+#include <fcntl.h>
+#include <io.h>
+#endif
+
+namespace {
+
+void decodeStream(const std::string& source, const std::shared_ptr<ProgramImage>& image) {
+    InstructionFactory factory;
+    std::exception_ptr error;
+    bool ownsInput = source != "-";
+    std::FILE* input = stdin;
+
+    try {
+        if (ownsInput) {
+            input = std::fopen(source.c_str(), "rb");
+            if (input == nullptr) {
+                throw VMException("Error: Cannot open stream " + source);
+            }
+        } else {
+#ifdef _WIN32
+            _setmode(_fileno(stdin), _O_BINARY);
+#endif
+        }
+
+        int index = 0;
+        uint8_t bytes[4];
+        while (true) {
+            size_t received = std::fread(bytes, 1, sizeof(bytes), input);
+            if (received == 0) {
+                break;
+            }
+            if (received != sizeof(bytes)) {
+                throw VMException("Error: Stream size is not a multiple of 4 bytes.");
+            }
+
+            uint32_t raw = static_cast<uint32_t>(bytes[0]) |
+                           (static_cast<uint32_t>(bytes[1]) << 8) |
+                           (static_cast<uint32_t>(bytes[2]) << 16) |
+                           (static_cast<uint32_t>(bytes[3]) << 24);
+            image->append(factory.createInstruction(raw, index));
+            index++;
+        }
+        if (std::ferror(input)) {
+            throw VMException("Error: Failed to read instruction stream.");
+        }
+    } catch (const VMException&) {
+        error = std::current_exception();
+    } catch (const std::exception& e) {
+        error = std::make_exception_ptr(VMException(e.what()));
+    }
+
+    if (ownsInput && input != nullptr) {
+        std::fclose(input);
+    }
+    image->finish(error);
+}
+
+}
+
+StreamLoader::StreamLoader(const std::string& source) : m_image(ProgramImage::createStreaming()) {
+    // Detached: a VM that stops early must not wait for the writer to close the pipe.
+    std::thread(decodeStream, source, m_image).detach();
+}
+
+std::shared_ptr<const ProgramImage> StreamLoader::getImage() const {
+    return m_image;
+}
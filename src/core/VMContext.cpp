@@ -1,8 +1,9 @@
 #include "core/VMContext.h"
 #include "core/VMException.h"
 #include <stdexcept>
+#include <iostream>
 
-VMContext::VMContext() : m_registers{}, m_stackMemory{} {
+VMContext::VMContext() : m_program(), m_dispatchTable(nullptr), m_output(&std::cout), m_executedCount(0), m_registers{}, m_stackMemory{} {
     setRegisterInternal(RegisterID::R0, 0);
     setRegisterInternal(RegisterID::R1, 0);
     setRegisterInternal(RegisterID::R2, 0);
@@ -16,35 +17,90 @@ VMContext::VMContext() : m_registers{}, m_stackMemory{} {
 }
 
 void VMContext::loadProgram(std::vector<std::unique_ptr<IInstruction>> program) {
-    if (program.size() > 255) {
-        throw std::runtime_error("Program too large: Max 255 instructions allowed.");
-    }
-    m_program = std::move(program);
+    loadProgram(std::make_shared<const ProgramImage>(std::move(program)));
+}
+
+void VMContext::loadProgram(std::shared_ptr<const ProgramImage> image) {
+    m_program = std::move(image);
+    m_dispatchTable = nullptr;
+}
+
+const std::shared_ptr<const ProgramImage>& VMContext::getProgram() const {
+    return m_program;
+}
+
+void VMContext::setDispatchTable(const IInstruction* const* dispatchTable) {
+    m_dispatchTable = dispatchTable;
+}
+
+size_t VMContext::programSize() const {
+    return m_program ? m_program->size() : 0;
 }
 
 void VMContext::run() {
+    if (!m_program) {
+        return;
+    }
+    const IInstruction* const* dispatchTable =
+        m_dispatchTable ? m_dispatchTable : m_program->getDispatchTable();
+
     try {
         while (true) {
+            // Returns at once for a complete image; blocks a streamed one until PC's instruction arrives.
+            size_t instructionCount = m_program->waitFor(getRegister(RegisterID::PC));
             uint8_t pc = getRegister(RegisterID::PC);
-            if (pc >= m_program.size()) {
-                 break; 
-            }
 
-            if (!m_program[pc]) {
-                throw std::runtime_error("Null instruction pointer encountered at index " + std::to_string(pc));
+            if (pc > m_program->size()) {
+                throw std::runtime_error("Program Counter out of bounds: " + std::to_string(pc));
+            }
+            if (pc >= instructionCount) {
+                break;
+            }
+            if (!dispatch(dispatchTable, instructionCount)) {
+                return;
             }
+        }
+    } catch (const std::exception& e) {
+        if (dynamic_cast<const VMException*>(&e)) {
+            throw;
+        }
+        throw VMException(e.what(), static_cast<int>(getRegister(RegisterID::PC)));
+    }
+}
 
-            IInstruction* currentInstruction = m_program[pc].get();
-            
-            ExecutionResult result = currentInstruction->execute(*this);
+bool VMContext::dispatch(const IInstruction* const* dispatchTable, const size_t instructionCount) {
+    uint8_t pc;
+    while ((pc = getRegister(RegisterID::PC)) < instructionCount) {
+        const IInstruction* currentInstruction = dispatchTable[pc];
 
-            if (result == ExecutionResult::Next) {
-                incrementPC();
-            }
+        ExecutionResult result = currentInstruction->execute(*this);
 
-            if (getRegister(RegisterID::PC) > m_program.size()) {
-                throw std::runtime_error("Program Counter out of bounds: " + std::to_string(getRegister(RegisterID::PC)));
-            }
+        if (result == ExecutionResult::Next) {
+            incrementPC();
+        } else if (result == ExecutionResult::Break) {
+            return false;
+        }
+        m_executedCount++;
+    }
+    return true;
+}
+
+bool VMContext::step() {
+    const size_t instructionCount = programSize();
+    if (getRegister(RegisterID::PC) >= instructionCount) {
+        return false;
+    }
+
+    try {
+        const IInstruction* currentInstruction = m_program->getInstruction(getRegister(RegisterID::PC));
+
+        if (currentInstruction->execute(*this) == ExecutionResult::Next) {
+            incrementPC();
+        }
+        m_executedCount++;
+
+        if (getRegister(RegisterID::PC) > instructionCount) {
+            throw std::runtime_error("Program Counter out of bounds: " + std::to_string(getRegister(RegisterID::PC)));
         }
     } catch (const std::exception& e) {
         if (dynamic_cast<const VMException*>(&e)) {
@@ -52,6 +108,19 @@ void VMContext::run() {
         }
         throw VMException(e.what(), static_cast<int>(getRegister(RegisterID::PC)));
     }
+    return true;
+}
+
+uint64_t VMContext::getExecutedCount() const {
+    return m_executedCount;
+}
+
+void VMContext::setOutput(std::ostream& output) {
+    m_output = &output;
+}
+
+std::ostream& VMContext::getOutput() const {
+    return *m_output;
 }
 
 uint8_t VMContext::getRegister(uint8_t regId) const {
@@ -98,25 +167,16 @@ void VMContext::setFlag(const RegisterID flag, bool value) {
     setRegisterInternal(flag, (value ? 1 : 0));
 }
 
-void VMContext::pushStack(uint8_t value) {
-    uint8_t sp = getRegister(RegisterID::SP);
-    if (sp == 0) {
-        throw std::runtime_error("Error: Stack Overflow");
-    }
-    sp--;
-    m_stackMemory[sp] = value;
-    setRegisterInternal(RegisterID::SP, sp);
+void VMContext::throwStackOverflow() {
+    throw std::runtime_error("Error: Stack Overflow");
 }
 
-uint8_t VMContext::popStack() {
-    uint8_t sp = getRegister(RegisterID::SP);
-    if (sp == STACK_SIZE - 1) {
-        throw std::runtime_error("Error: Stack Underflow");
-    }
-    uint8_t value = m_stackMemory[sp];
-    sp++;
-    setRegisterInternal(RegisterID::SP, sp);
-    return value;
+void VMContext::throwStackUnderflow() {
+    throw std::runtime_error("Error: Stack Underflow");
+}
+
+uint8_t VMContext::readStackSlot(uint8_t address) const {
+    return m_stackMemory[address];
 }
 
 void VMContext::incrementPC() {
@@ -124,7 +184,7 @@ void VMContext::incrementPC() {
 }
 
 void VMContext::setPC(uint8_t address) {
-    if (address >= m_program.size()) {
+    if (!m_program || address >= m_program->waitFor(address)) {
         throw std::runtime_error("Invalid Jump Address: " + std::to_string(address));
     }
     setRegisterInternal(RegisterID::PC, address);
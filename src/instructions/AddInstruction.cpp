@@ -4,7 +4,7 @@
 AddInstruction::AddInstruction(uint8_t flag, uint8_t src, uint8_t dest)
     : IInstruction(flag, src, dest) {}
 
-ExecutionResult AddInstruction::execute(VMContext& context) {
+ExecutionResult AddInstruction::execute(VMContext& context) const {
     uint8_t val1 = context.getRegister(m_dest);
     uint8_t val2 = resolveValue(context, m_src);
 
@@ -4,7 +4,7 @@
 BeInstruction::BeInstruction(uint8_t flag, uint8_t src, uint8_t dest)
     : IInstruction(flag, src, dest) {}
 
-ExecutionResult BeInstruction::execute(VMContext& context) {
+ExecutionResult BeInstruction::execute(VMContext& context) const {
     if (context.getFlag(RegisterID::ZF)) {
         uint8_t jumpAddress = resolveValue(context, m_dest);
         context.setPC(jumpAddress);
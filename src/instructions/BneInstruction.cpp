@@ -4,7 +4,7 @@
 BneInstruction::BneInstruction(uint8_t flag, uint8_t src, uint8_t dest)
     : IInstruction(flag, src, dest) {}
 
-ExecutionResult BneInstruction::execute(VMContext& context) {
+ExecutionResult BneInstruction::execute(VMContext& context) const {
     if (!context.getFlag(RegisterID::ZF)) {
         uint8_t jumpAddress = resolveValue(context, m_dest);
         context.setPC(jumpAddress);
@@ -4,7 +4,7 @@
 CmpInstruction::CmpInstruction(uint8_t flag, uint8_t src, uint8_t dest)
     : IInstruction(flag, src, dest) {}
 
-ExecutionResult CmpInstruction::execute(VMContext& context) {
+ExecutionResult CmpInstruction::execute(VMContext& context) const {
     uint8_t val1_unsigned = context.getRegister(m_dest);
     uint8_t val2_unsigned = resolveValue(context, m_src);
 
@@ -4,7 +4,7 @@
 JmpInstruction::JmpInstruction(uint8_t flag, uint8_t src, uint8_t dest)
     : IInstruction(flag, src, dest) {}
 
-ExecutionResult JmpInstruction::execute(VMContext& context) {
+ExecutionResult JmpInstruction::execute(VMContext& context) const {
     uint8_t jumpAddress = resolveValue(context, m_dest);
     context.setPC(jumpAddress);
     return ExecutionResult::Jumped;
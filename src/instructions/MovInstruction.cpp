@@ -4,7 +4,7 @@
 MovInstruction::MovInstruction(uint8_t flag, uint8_t src, uint8_t dest)
     : IInstruction(flag, src, dest) {}
 
-ExecutionResult MovInstruction::execute(VMContext& context) {
+ExecutionResult MovInstruction::execute(VMContext& context) const {
     uint8_t valueToMove = resolveValue(context, m_src);
     context.setRegister(m_dest, valueToMove);
     return ExecutionResult::Next;
@@ -4,7 +4,7 @@
 PopInstruction::PopInstruction(uint8_t flag, uint8_t src, uint8_t dest)
     : IInstruction(flag, src, dest) {}
 
-ExecutionResult PopInstruction::execute(VMContext& context) {
+ExecutionResult PopInstruction::execute(VMContext& context) const {
     uint8_t value = context.popStack();
     context.setRegister(m_dest, value);
     return ExecutionResult::Next;
@@ -1,12 +1,13 @@
 #include "instructions/PrintInstruction.h"
 #include "core/VMContext.h"
-#include <iostream>
+#include <ostream>
+#include <string>
 
 PrintInstruction::PrintInstruction(uint8_t flag, uint8_t src, uint8_t dest)
     : IInstruction(flag, src, dest) {}
 
-ExecutionResult PrintInstruction::execute(VMContext& context) {
+ExecutionResult PrintInstruction::execute(VMContext& context) const {
     uint8_t valueToPrint = resolveValue(context, m_dest);
-    std::cout << std::to_string(static_cast<int8_t>(valueToPrint)) << std::endl;
+    context.getOutput() << std::to_string(static_cast<int8_t>(valueToPrint)) << std::endl;
     return ExecutionResult::Next;
 }
@@ -4,7 +4,7 @@
 PushInstruction::PushInstruction(uint8_t flag, uint8_t src, uint8_t dest)
     : IInstruction(flag, src, dest) {}
 
-ExecutionResult PushInstruction::execute(VMContext& context) {
+ExecutionResult PushInstruction::execute(VMContext& context) const {
     uint8_t value = resolveValue(context, m_dest);
     context.pushStack(value);
     return ExecutionResult::Next;
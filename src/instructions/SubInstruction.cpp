@@ -4,7 +4,7 @@
 SubInstruction::SubInstruction(uint8_t flag, uint8_t src, uint8_t dest)
     : IInstruction(flag, src, dest) {}
 
-ExecutionResult SubInstruction::execute(VMContext& context) {
+ExecutionResult SubInstruction::execute(VMContext& context) const {
     uint8_t val1 = context.getRegister(m_dest);
     uint8_t val2 = resolveValue(context, m_src);
 
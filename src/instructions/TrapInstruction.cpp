@@ -0,0 +1,9 @@
+#include "instructions/TrapInstruction.h"
+#include "core/VMContext.h"
+
+TrapInstruction::TrapInstruction()
+    : IInstruction(0, 0, 0) {}
+
+ExecutionResult TrapInstruction::execute(VMContext&) const {
+    return ExecutionResult::Break;
+}
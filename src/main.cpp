@@ -1,36 +1,239 @@
 #include <iostream>
+#include <sstream>
 #include <string>
 #include <vector>
 #include <memory>
+#include <cctype>
+#include <stdexcept>
 
 #include "core/VMLoader.h"
 #include "core/InstructionFactory.h"
 #include "core/VMContext.h"
 #include "core/VMException.h"
+#include "core/ProgramBundle.h"
+#include "core/ResultCache.h"
+#include "core/Debugger.h"
+#include "core/DebugShell.h"
+#include "core/StreamLoader.h"
 
-int main(int argc, char* argv[]) {
-    if (argc < 2) {
-        std::cerr << "Usage: " << argv[0] << " <path_to_bin_file" << std::endl;
-        return 1;
+struct RunOptions {
+    std::string bundlePath;
+    std::string streamSource;
+    std::string cacheDirectory;
+    uint64_t cacheMaxBytes = ResultCache::DEFAULT_MAX_BYTES;
+    bool printCacheStats = false;
+    bool debug = false;
+    std::vector<std::string> positional;
+};
+
+static void printUsage(const char* programName) {
+    std::cerr << "Usage: " << programName << " [options] <path_to_bin_file>" << std::endl;
+    std::cerr << "       " << programName << " [options] --bundle <path_to_bundle> [name|index ...]" << std::endl;
+    std::cerr << "       " << programName << " --stream <path_to_pipe|->" << std::endl;
+    std::cerr << "Options:" << std::endl;
+    std::cerr << "  --debug               Run the program under the interactive debugger" << std::endl;
+    std::cerr << "  --cache <dir>         Reuse results of previously executed programs" << std::endl;
+    std::cerr << "  --cache-size <bytes>  Maximum cache size before LRU eviction" << std::endl;
+    std::cerr << "  --cache-stats         Print cache hit/miss statistics to stderr" << std::endl;
+}
+
+static bool parseArguments(int argc, char* argv[], RunOptions& options) {
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        bool hasValue = i + 1 < argc;
+
+        if (arg == "--bundle" && hasValue) {
+            options.bundlePath = argv[++i];
+        } else if (arg == "--stream" && hasValue) {
+            options.streamSource = argv[++i];
+        } else if (arg == "--cache" && hasValue) {
+            options.cacheDirectory = argv[++i];
+        } else if (arg == "--cache-size" && hasValue) {
+            options.cacheMaxBytes = std::stoull(argv[++i]);
+        } else if (arg == "--cache-stats") {
+            options.printCacheStats = true;
+        } else if (arg == "--debug") {
+            options.debug = true;
+        } else if (arg.rfind("--", 0) == 0) {
+            return false;
+        } else {
+            options.positional.push_back(arg);
+        }
+    }
+    if (!options.streamSource.empty()) {
+        return options.bundlePath.empty() && options.positional.empty() && !options.debug &&
+               options.cacheDirectory.empty() && !options.printCacheStats;
     }
-    std::string filePath = argv[1];
+    if (options.debug) {
+        return options.bundlePath.empty() && options.positional.size() == 1;
+    }
+    return !options.bundlePath.empty() || options.positional.size() == 1;
+}
 
+static CachedResult executeProgram(InstructionFactory& factory, const std::vector<uint32_t>& rawCode, std::ostream& output) {
+    CachedResult result;
     try {
-        std::vector<uint32_t> rawCode = VMLoader::loadBinaryFile(filePath);
-
-        InstructionFactory factory;
         std::vector<std::unique_ptr<IInstruction>> program = factory.createProgram(rawCode);
 
         VMContext vm;
+        vm.setOutput(output);
         vm.loadProgram(std::move(program));
         vm.run();
     } catch (const VMException& e) {
-        std::cerr << "[VM Error] " << e.getFullMessage() << std::endl;
+        result.exitStatus = 1;
+        result.errorMessage = "[VM Error] " + e.getFullMessage();
+    } catch (const std::exception& e) {
+        result.exitStatus = 1;
+        result.errorMessage = "[System Error] " + std::string(e.what());
+    }
+    return result;
+}
+
+static int runProgram(InstructionFactory& factory, const std::vector<uint32_t>& rawCode,
+                      ResultCache* cache, const std::string& label) {
+    CachedResult result;
+    if (cache == nullptr) {
+        result = executeProgram(factory, rawCode, std::cout);
+    } else {
+        std::string key = ResultCache::computeKey(rawCode);
+        if (auto cached = cache->lookup(key)) {
+            result = std::move(*cached);
+        } else {
+            std::ostringstream captured;
+            result = executeProgram(factory, rawCode, captured);
+            result.output = captured.str();
+            cache->store(key, result);
+        }
+        std::cout << result.output << std::flush;
+    }
+
+    if (!result.errorMessage.empty()) {
+        std::cerr << (label.empty() ? "" : label + ": ") << result.errorMessage << std::endl;
+    }
+    return result.exitStatus;
+}
+
+static size_t resolveBundleSelector(const ProgramBundle& bundle, const std::string& selector) {
+    bool numeric = !selector.empty();
+    for (char c : selector) {
+        numeric = numeric && std::isdigit(static_cast<unsigned char>(c));
+    }
+    if (!numeric) {
+        return bundle.findIndex(selector);
+    }
+
+    for (size_t i = 0; i < bundle.size(); ++i) {
+        if (bundle.getName(i) == selector) {
+            return i;
+        }
+    }
+    if (selector.size() > 9 || std::stoul(selector) >= bundle.size()) {
+        throw std::runtime_error("Error: Bundle index out of range: " + selector);
+    }
+    return std::stoul(selector);
+}
+
+static int runBundle(const RunOptions& options, ResultCache* cache) {
+    ProgramBundle bundle(options.bundlePath);
+    InstructionFactory factory;
+
+    std::vector<size_t> indices;
+    if (options.positional.empty()) {
+        for (size_t i = 0; i < bundle.size(); ++i) {
+            indices.push_back(i);
+        }
+    } else {
+        for (const std::string& selector : options.positional) {
+            indices.push_back(resolveBundleSelector(bundle, selector));
+        }
+    }
+
+    int exitCode = 0;
+    for (size_t index : indices) {
+        std::vector<uint32_t> rawCode;
+        try {
+            rawCode = bundle.loadProgram(index);
+        } catch (const std::exception& e) {
+            std::cerr << bundle.getName(index) << ": [System Error] " << e.what() << std::endl;
+            exitCode = 1;
+            continue;
+        }
+
+        if (runProgram(factory, rawCode, cache, bundle.getName(index)) != 0) {
+            exitCode = 1;
+        }
+    }
+    return exitCode;
+}
+
+static int runDebugger(const std::vector<uint32_t>& rawCode) {
+    InstructionFactory factory;
+    VMContext vm;
+    vm.loadProgram(factory.createProgram(rawCode));
+
+    Debugger debugger(vm);
+    DebugShell shell(debugger, std::cin, std::cout);
+    shell.run();
+    return 0;
+}
+
+static int runStream(const std::string& source) {
+    StreamLoader loader(source);
+
+    VMContext vm;
+    vm.loadProgram(loader.getImage());
+    vm.run();
+    return 0;
+}
+
+static void printCacheStats(const CacheStats& stats) {
+    std::cerr << "[Cache] hits=" << stats.hits << " misses=" << stats.misses
+              << " stores=" << stats.stores << " evictions=" << stats.evictions << std::endl;
+}
+
+int main(int argc, char* argv[]) {
+    RunOptions options;
+    try {
+        if (!parseArguments(argc, argv, options)) {
+            printUsage(argv[0]);
+            return 1;
+        }
+    } catch (const std::exception&) {
+        printUsage(argv[0]);
         return 1;
+    }
+
+    int exitCode = 0;
+    std::unique_ptr<ResultCache> cache;
+    try {
+        if (!options.cacheDirectory.empty()) {
+            cache = std::make_unique<ResultCache>(options.cacheDirectory, options.cacheMaxBytes);
+        }
+
+        if (!options.streamSource.empty()) {
+            exitCode = runStream(options.streamSource);
+        } else if (!options.bundlePath.empty()) {
+            exitCode = runBundle(options, cache.get());
+        } else {
+            std::vector<uint32_t> rawCode = VMLoader::loadBinaryFile(options.positional.front());
+
+            if (options.debug) {
+                exitCode = runDebugger(rawCode);
+            } else {
+                InstructionFactory factory;
+                exitCode = runProgram(factory, rawCode, cache.get(), "");
+            }
+        }
+    } catch (const VMException& e) {
+        std::cerr << "[VM Error] " << e.getFullMessage() << std::endl;
+        exitCode = 1;
     } catch (const std::exception& e) {
         std::cerr << "[System Error] " << e.what() << std::endl;
-        return 1;
+        exitCode = 1;
     }
 
-    return 0;
+    if (cache && options.printCacheStats) {
+        printCacheStats(cache->getStats());
+    }
+    return exitCode;
 }
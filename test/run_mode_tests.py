@@ -0,0 +1,244 @@
+"""Scripted checks for the VM's non-file execution modes."""
+
+from __future__ import annotations
+
+import argparse
+import os
+import subprocess
+import sys
+import tempfile
+import time
+from dataclasses import dataclass
+from pathlib import Path
+from typing import Callable
+
+from run_tests import DEFAULT_TIMEOUT, Color, find_executable
+
+# =============================================================================
+# Check Context
+# =============================================================================
+
+
+@dataclass
+class Context:
+    """Paths shared by all checks."""
+
+    executable: Path
+    test_dir: Path
+    work_dir: Path
+    timeout: int
+
+    @property
+    def bin_dir(self) -> Path:
+        return self.test_dir / "bin"
+
+    @property
+    def answer_dir(self) -> Path:
+        return self.test_dir / "answer"
+
+    def tool(self, name: str) -> Path:
+        suffix = ".exe" if sys.platform == "win32" else ""
+        return self.executable.parent / f"{name}{suffix}"
+
+    def run(self, *args: object, stdin: bytes | None = None) -> subprocess.CompletedProcess[bytes]:
+        return subprocess.run(
+            [self.executable, *map(str, args)],
+            input=stdin,
+            capture_output=True,
+            timeout=self.timeout,
+            check=False,
+        )
+
+    def answer(self, name: str) -> str:
+        return normalize((self.answer_dir / f"{name}.txt").read_bytes())
+
+
+def normalize(output: bytes) -> str:
+    return output.decode("utf-8").replace("\r\n", "\n").strip()
+
+
+class CheckFailed(Exception):
+    """Raised by a check when an expectation does not hold."""
+
+
+def expect(condition: bool, message: str) -> None:
+    if not condition:
+        raise CheckFailed(message)
+
+
+# =============================================================================
+# Checks
+# =============================================================================
+
+
+def check_bundle(ctx: Context) -> None:
+    """vm_pack round-trip, then --bundle by name, by index and all programs."""
+    bundle = ctx.work_dir / "programs.bundle"
+    packed = subprocess.run(
+        [ctx.tool("vm_pack"), ctx.bin_dir, bundle], capture_output=True, timeout=ctx.timeout, check=False
+    )
+    expect(packed.returncode == 0, f"vm_pack failed: {packed.stderr.decode().strip()}")
+
+    names = sorted(path.stem for path in ctx.bin_dir.glob("*.bin"))
+
+    by_name = ctx.run("--bundle", bundle, "stack")
+    expect(by_name.returncode == 0, f"--bundle stack exited {by_name.returncode}")
+    expect(normalize(by_name.stdout) == ctx.answer("stack"), "--bundle stack output mismatch")
+
+    by_index = ctx.run("--bundle", bundle, names.index("add"))
+    expect(by_index.returncode == 0, f"--bundle by index exited {by_index.returncode}")
+    expect(normalize(by_index.stdout) == ctx.answer("add"), "--bundle by index output mismatch")
+
+    everything = ctx.run("--bundle", bundle)
+    expected = "\n".join(ctx.answer(name) for name in names)
+    expect(everything.returncode == 0, f"--bundle (all) exited {everything.returncode}")
+    expect(normalize(everything.stdout) == expected, "--bundle (all) output mismatch")
+
+    out_of_range = ctx.run("--bundle", bundle, len(names))
+    expect(out_of_range.returncode != 0 and not out_of_range.stdout, "out-of-range index should fail before running")
+
+
+def check_cache(ctx: Context) -> None:
+    """A miss then a hit on an erroring program report the same result."""
+    cache_dir = ctx.work_dir / "cache"
+    program = ctx.work_dir / "underflow.bin"
+    program.write_bytes(bytes([0x07 << 2 | 0b10, 0x00, 0x00, 0x01]))  # POP R0
+
+    miss = ctx.run("--cache", cache_dir, "--cache-stats", program)
+    hit = ctx.run("--cache", cache_dir, "--cache-stats", program)
+
+    expect(b"hits=0 misses=1" in miss.stderr, "first run should be a cache miss")
+    expect(b"hits=1 misses=0" in hit.stderr, "second run should be a cache hit")
+    expect(miss.returncode == 1 and hit.returncode == miss.returncode, "exit status differs between miss and hit")
+
+    def error_line(result: subprocess.CompletedProcess[bytes]) -> str:
+        return normalize(result.stderr).splitlines()[0]
+
+    expect("Stack Underflow" in error_line(miss), "miss should report the VM error")
+    expect(error_line(hit) == error_line(miss), "error message differs between miss and hit")
+
+    ctx.run("--cache", cache_dir, ctx.bin_dir / "loop.bin")
+    replay = ctx.run("--cache", cache_dir, ctx.bin_dir / "loop.bin")
+    expect(normalize(replay.stdout) == ctx.answer("loop"), "cached output mismatch")
+
+    # Header lengths far beyond the file size must read as a miss, not an allocation failure.
+    for entry in cache_dir.glob("*.vmr"):
+        data = bytearray(entry.read_bytes())
+        data[12:16] = (0xFFFFFFF0).to_bytes(4, "little")
+        entry.write_bytes(data)
+    corrupt = ctx.run("--cache", cache_dir, "--cache-stats", ctx.bin_dir / "loop.bin")
+    expect(corrupt.returncode == 0, f"corrupt entry run exited {corrupt.returncode}")
+    expect(b"hits=0 misses=1" in corrupt.stderr, "a corrupt entry should be a cache miss")
+    expect(normalize(corrupt.stdout) == ctx.answer("loop"), "output after corrupt entry mismatch")
+
+    stale = cache_dir / f"{'0' * 64}.vmr.tmp.1"
+    stale.write_bytes(b"partial")
+    old = time.time() - 3600
+    os.utime(stale, (old, old))
+    ctx.run("--cache", cache_dir, ctx.bin_dir / "add.bin")
+    expect(not stale.exists(), "a stale temp file should be removed on eviction")
+
+
+def check_stream(ctx: Context) -> None:
+    """Every test program piped through --stream -, then a truncated stream."""
+    for program in sorted(ctx.bin_dir.glob("*.bin")):
+        streamed = ctx.run("--stream", "-", stdin=program.read_bytes())
+        expect(streamed.returncode == 0, f"--stream {program.name} exited {streamed.returncode}")
+        expect(normalize(streamed.stdout) == ctx.answer(program.stem), f"--stream {program.name} output mismatch")
+
+    truncated = ctx.run("--stream", "-", stdin=b"abc")
+    expect(truncated.returncode != 0, "a trailing partial word should fail")
+    expect(b"not a multiple of 4 bytes" in truncated.stderr, "trailing bytes should be reported")
+
+    combined = ctx.run("--stream", "-", "--cache", ctx.work_dir / "cache", stdin=b"")
+    expect(combined.returncode != 0, "--stream with --cache should be rejected")
+
+
+def check_debug(ctx: Context) -> None:
+    """Scripted break, continue, delete, watch and step session on loop.bin."""
+    script = [
+        "break 2",
+        "continue",
+        "delete 2",
+        "watch R0",
+        "continue",
+        "unwatch R0",
+        "step abc",
+        "step -1",
+        "step 2",
+        "continue",
+        "quit",
+    ]
+    session = ctx.run("--debug", ctx.bin_dir / "loop.bin", stdin="\n".join(script).encode() + b"\n")
+    expect(session.returncode == 0, f"--debug exited {session.returncode}")
+
+    transcript = [line for line in normalize(session.stdout.replace(b"(vmdb) ", b"\n")).splitlines() if line]
+    expected = [
+        "Breakpoint set at [2]",
+        "1",
+        "Breakpoint hit at [2]",
+        "Breakpoint removed at [2]",
+        "Watchpoint R0: 1 -> 2, stopped at [3]",
+        "Usage: step [n] (1-255)",
+        "Usage: step [n] (1-255)",
+        "Stopped at [1]",
+        "2",
+        "3",
+        "100",
+        "Program finished.",
+    ]
+    expect(transcript == expected, f"debugger transcript mismatch: {transcript}")
+
+
+CHECKS: list[tuple[str, Callable[[Context], None]]] = [
+    ("bundle", check_bundle),
+    ("cache", check_cache),
+    ("stream", check_stream),
+    ("debug", check_debug),
+]
+
+
+# =============================================================================
+# CLI
+# =============================================================================
+
+
+def parse_args() -> argparse.Namespace:
+    """Parse command line arguments."""
+    parser = argparse.ArgumentParser(description="Execution Mode Checks for VM Project")
+    parser.add_argument("--exe", type=Path, help="Path to the VM executable")
+    parser.add_argument("--timeout", type=int, default=DEFAULT_TIMEOUT, help="Timeout per run in seconds")
+    return parser.parse_args()
+
+
+def main() -> int:
+    """Main entry point."""
+    args = parse_args()
+
+    test_dir = Path(__file__).parent.resolve()
+    executable = args.exe or find_executable(test_dir.parent)
+
+    if not executable:
+        print(f"{Color.RED}Error: Could not find executable.{Color.RESET}")
+        print("Build the project first or specify path with --exe")
+        return 1
+
+    passed = 0
+    with tempfile.TemporaryDirectory() as work_dir:
+        ctx = Context(Path(executable).resolve(), test_dir, Path(work_dir), args.timeout)
+        for name, check in CHECKS:
+            try:
+                check(ctx)
+                print(f"{Color.GREEN}[PASS]{Color.RESET} {name}")
+                passed += 1
+            except (CheckFailed, OSError, subprocess.TimeoutExpired) as e:
+                print(f"{Color.RED}[FAIL]{Color.RESET} {name}: {e}")
+
+    print(f"\n{'=' * 50}")
+    print(f"RESULT: {passed}/{len(CHECKS)} passed")
+    print("=" * 50)
+    return 0 if passed == len(CHECKS) else 1
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,94 @@
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "core/BundleFormat.h"
+#include "core/VMLoader.h"
+
+namespace fs = std::filesystem;
+
+static size_t alignUp(size_t value, size_t alignment) {
+    return (value + alignment - 1) / alignment * alignment;
+}
+
+int main(int argc, char* argv[]) {
+    if (argc < 3) {
+        std::cerr << "Usage: " << argv[0] << " <bin_directory> <output_bundle>" << std::endl;
+        return 1;
+    }
+    fs::path inputDir = argv[1];
+    std::string outputPath = argv[2];
+
+    try {
+        if (!fs::is_directory(inputDir)) {
+            throw std::runtime_error("Error: " + inputDir.string() + " is not a directory.");
+        }
+
+        std::vector<fs::path> files;
+        for (const auto& item : fs::directory_iterator(inputDir)) {
+            if (item.is_regular_file() && item.path().extension() == ".bin") {
+                files.push_back(item.path());
+            }
+        }
+        std::sort(files.begin(), files.end());
+
+        std::vector<BundleEntry> entries(files.size());
+        std::vector<std::vector<uint32_t>> payloads;
+        payloads.reserve(files.size());
+
+        size_t offset = alignUp(sizeof(BundleHeader) + files.size() * sizeof(BundleEntry), BUNDLE_ALIGNMENT);
+        for (size_t i = 0; i < files.size(); ++i) {
+            std::string name = files[i].stem().string();
+            if (name.size() >= BUNDLE_NAME_LENGTH) {
+                throw std::runtime_error("Error: Program name too long for bundle index: " + name);
+            }
+
+            payloads.push_back(VMLoader::loadBinaryFile(files[i].string()));
+            const std::vector<uint32_t>& words = payloads.back();
+            size_t length = words.size() * sizeof(uint32_t);
+
+            BundleEntry& entry = entries[i];
+            std::memset(&entry, 0, sizeof(entry));
+            std::memcpy(entry.name, name.data(), name.size());
+            entry.offset = static_cast<uint32_t>(offset);
+            entry.length = static_cast<uint32_t>(length);
+            entry.checksum = bundleChecksum(reinterpret_cast<const uint8_t*>(words.data()), length);
+
+            offset = alignUp(offset + length, BUNDLE_ALIGNMENT);
+        }
+
+        BundleHeader header{};
+        std::memcpy(header.magic, BUNDLE_MAGIC, sizeof(BUNDLE_MAGIC));
+        header.version = BUNDLE_VERSION;
+        header.entryCount = static_cast<uint32_t>(entries.size());
+        header.indexOffset = sizeof(BundleHeader);
+
+        std::vector<char> image(offset, 0);
+        std::memcpy(image.data(), &header, sizeof(header));
+        if (!entries.empty()) {
+            std::memcpy(image.data() + header.indexOffset, entries.data(), entries.size() * sizeof(BundleEntry));
+        }
+        for (size_t i = 0; i < entries.size(); ++i) {
+            if (entries[i].length > 0) {
+                std::memcpy(image.data() + entries[i].offset, payloads[i].data(), entries[i].length);
+            }
+        }
+
+        std::ofstream out(outputPath, std::ios::binary | std::ios::trunc);
+        if (!out.is_open() || !out.write(image.data(), static_cast<std::streamsize>(image.size()))) {
+            throw std::runtime_error("Error: Failed to write bundle " + outputPath);
+        }
+
+        std::cout << "Packed " << entries.size() << " programs into " << outputPath
+                  << " (" << image.size() << " bytes)" << std::endl;
+    } catch (const std::exception& e) {
+        std::cerr << "[System Error] " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}